@@ -0,0 +1,26 @@
+#version 330 core
+layout(location = 0) in vec3 pos;
+layout(location = 1) in vec3 color;
+
+// per instance (glVertexAttribDivisor 1), see CubeInstance in cube_instances.h
+layout(location = 2) in vec4 modelRow0;
+layout(location = 3) in vec4 modelRow1;
+layout(location = 4) in vec4 modelRow2;
+layout(location = 5) in vec4 instanceColor;
+
+// per frame constants, bound to FRAME_CONSTANTS_BINDING (see frame_constants.h)
+layout(std140) uniform FrameConstants
+{
+    mat4 MVP;
+    vec4 time;
+};
+
+out vec3 fragmentColor;
+
+void main()
+{
+    vec4 p = vec4(pos, 1.0);
+    vec3 world = vec3(dot(modelRow0, p), dot(modelRow1, p), dot(modelRow2, p));
+    gl_Position = MVP * vec4(world, 1.0);
+    fragmentColor = color * instanceColor.rgb;
+}
@@ -1,3 +1,8 @@
-version https://git-lfs.github.com/spec/v1
-oid sha256:4a6e05b59b6c809d7cf28684326e1ac0c3f900112775cf56fc109dcee2fe0878
-size 135
+#version 330 core
+in vec3 fragmentColor;
+out vec4 color;
+
+void main()
+{
+    color = vec4(fragmentColor, 1.0);
+}
@@ -1,3 +1,18 @@
-version https://git-lfs.github.com/spec/v1
-oid sha256:8ff0e90ba57569861d4b5a1ab8f89282b5762b7ad83a663d81365ece3d574b36
-size 340
+#version 330 core
+layout(location = 0) in vec3 pos;
+layout(location = 1) in vec3 color;
+
+// per frame constants, bound to FRAME_CONSTANTS_BINDING (see frame_constants.h)
+layout(std140) uniform FrameConstants
+{
+    mat4 MVP;
+    vec4 time;
+};
+
+out vec3 fragmentColor;
+
+void main()
+{
+    gl_Position = MVP * vec4(pos, 1.0);
+    fragmentColor = color;
+}
@@ -0,0 +1,15 @@
+#version 330 core
+in vec3 ourColor;
+in vec2 texCoord;
+
+out vec4 FragColor;
+
+// both images as layers of one GL_TEXTURE_2D_ARRAY (see texture_atlas.h)
+uniform sampler2DArray Sprites;
+uniform float Layer1;
+uniform float Layer2;
+
+void main()
+{
+    FragColor = mix(texture(Sprites, vec3(texCoord, Layer1)), texture(Sprites, vec3(texCoord, Layer2)), 0.2);
+}
@@ -0,0 +1,21 @@
+#version 330 core
+in vec3 ourColor;
+in vec2 texCoord;
+
+out vec4 FragColor;
+
+// both images packed in one atlas (see texture_atlas.h), Rect = uv offset + size of each sprite
+uniform sampler2D Sprites;
+uniform vec4 Rect1;
+uniform vec4 Rect2;
+
+vec4 sprite(vec4 rect)
+{
+    // no wrap around inside an atlas, the padding only covers filtering
+    return texture(Sprites, rect.xy + clamp(texCoord, 0.0, 1.0) * rect.zw);
+}
+
+void main()
+{
+    FragColor = mix(sprite(Rect1), sprite(Rect2), 0.2);
+}